@@ -2,10 +2,13 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <limits.h>
 
 #define MAX_LENGTH 255
 #define MAX_ITEMS 100
 #define MAX_BUDGETS 12
+#define MAX_SCENARIOS 100
+#define MAX_BUDGET_PERCENT 1000
 
 typedef struct {
     char name[MAX_LENGTH];
@@ -18,6 +21,28 @@ typedef struct {
     int budget_month;
 } Item;
 
+typedef struct {
+    char name[MAX_LENGTH];
+    char brand[MAX_LENGTH];
+    char purchase_link[MAX_LENGTH];
+    char category[MAX_LENGTH];
+} ItemText;
+
+/*
+Items are stored column by column: the small fields that every scan and filter reads are kept in
+their own dense arrays, and the long strings that are only needed for display are kept apart in text.
+The category column holds the category code from get_category_code.
+*/
+typedef struct {
+    int id[MAX_ITEMS];
+    int price[MAX_ITEMS];
+    time_t timestamp[MAX_ITEMS];
+    int budget_month[MAX_ITEMS];
+    int category[MAX_ITEMS];
+    ItemText text[MAX_ITEMS];
+    int count;
+} ItemTable;
+
 typedef struct {
     int month;
     int budget;
@@ -26,6 +51,27 @@ typedef struct {
     int item_count;
 } Budget;
 
+typedef struct {
+    char name[MAX_LENGTH];
+    int budget_percent;
+    char shift_category[MAX_LENGTH];
+    int shift_month;
+} Scenario;
+
+typedef struct {
+    int remaining[MAX_BUDGETS];
+    int dropped[MAX_BUDGETS];
+    int unbudgeted;
+} ScenarioResult;
+
+typedef struct {
+    int by_name[MAX_ITEMS];
+    int by_timestamp[MAX_ITEMS];
+    int by_price[MAX_ITEMS];
+    int by_category[MAX_ITEMS];
+    int count;
+} ItemIndex;
+
 /*
 Description: Generates a random unique ID for an item.
 Parameters: None
@@ -46,19 +92,28 @@ int is_valid_url(const char *url) {
 }
 
 /*
-Description: Checks if the given category matches predefined valid categories.
-Parameters: category - The category string to validate.
-Returns: 1 if valid, 0 otherwise.
+Description: Looks up the code of a category in the list of predefined valid categories.
+Parameters: category - The category string to look up.
+Returns: The position of the category in the list (0-9), or -1 if it is not a valid category.
 */
-int is_valid_category(const char *category) {
+int get_category_code(const char *category) {
     const char *valid_categories[] = {"furniture", "electronics", "appliances", "bedroom", "bathroom", 
                                        "living room", "dining room", "office", "outdoor", "miscellaneous"};
     for (int i = 0; i < 10; i++) {
         if (strcmp(category, valid_categories[i]) == 0) {
-            return 1;
+            return i;
         }
     }
-    return 0;
+    return -1;
+}
+
+/*
+Description: Checks if the given category matches predefined valid categories.
+Parameters: category - The category string to validate.
+Returns: 1 if valid, 0 otherwise.
+*/
+int is_valid_category(const char *category) {
+    return get_category_code(category) >= 0;
 }
 
 /*
@@ -77,53 +132,277 @@ void save_item_to_file(const Item *item) {
 }
 
 /*
-Description: Loads items from the "items.txt" file into an array.
+Description: Appends an item to the end of an item table.
+Parameters:
+items - Pointer to the item table.
+item - Pointer to the item to append.
+Returns: None.
+*/
+void append_item(ItemTable *items, const Item *item) {
+    int i = items->count;
+    items->id[i] = item->id;
+    items->price[i] = item->price;
+    items->timestamp[i] = item->timestamp;
+    items->budget_month[i] = item->budget_month;
+    items->category[i] = get_category_code(item->category);
+    strcpy(items->text[i].name, item->name);
+    strcpy(items->text[i].brand, item->brand);
+    strcpy(items->text[i].purchase_link, item->purchase_link);
+    strcpy(items->text[i].category, item->category);
+    items->count++;
+}
+
+/*
+Description: Removes an item from an item table, keeping the remaining items in order.
+Parameters:
+items - Pointer to the item table.
+pos - Position of the item to remove.
+Returns: None.
+*/
+void remove_item_at(ItemTable *items, int pos) {
+    int moved = items->count - pos - 1;
+    memmove(&items->id[pos], &items->id[pos + 1], moved * sizeof(int));
+    memmove(&items->price[pos], &items->price[pos + 1], moved * sizeof(int));
+    memmove(&items->timestamp[pos], &items->timestamp[pos + 1], moved * sizeof(time_t));
+    memmove(&items->budget_month[pos], &items->budget_month[pos + 1], moved * sizeof(int));
+    memmove(&items->category[pos], &items->category[pos + 1], moved * sizeof(int));
+    memmove(&items->text[pos], &items->text[pos + 1], moved * sizeof(ItemText));
+    items->count--;
+}
+
+/*
+Description: Loads items from the "items.txt" file into an item table.
 Parameters:
-items[] - Array to store loaded items.
-count - Pointer to an integer to store the number of loaded items.
+items - Pointer to the item table to store loaded items.
 Returns: None.
 */
-void load_items(Item items[], int *count) {
+void load_items(ItemTable *items) {
+    Item item;
+    items->count = 0;
     FILE *file = fopen("items.txt", "r");
     if (file == NULL) {
         printf("No existing items found.\n");
         return;
     }
-    *count = 0;
-    while (fscanf(file, "%d,%[^,],%[^,],%d,%[^,],%[^,],%ld\n", &items[*count].id, items[*count].name, items[*count].brand, &items[*count].price, items[*count].purchase_link, items[*count].category, &items[*count].timestamp) != EOF) {
-        (*count)++;
+    item.budget_month = 0;
+    while (items->count < MAX_ITEMS &&
+           fscanf(file, "%d,%[^,],%[^,],%d,%[^,],%[^,],%ld\n", &item.id, item.name, item.brand, &item.price, item.purchase_link, item.category, &item.timestamp) != EOF) {
+        append_item(items, &item);
     }
     fclose(file);
 }
 
 /*
-Description: Saves all items from the array to "items.txt" (overwrites the file).
+Description: Saves all items from the item table to "items.txt" (overwrites the file).
 Parameters:
-items[] - Array of items to be saved.
-count - Number of items in the array.
+items - Pointer to the item table to be saved.
 Returns: None.
 */
-void save_items(Item items[], int count) {
+void save_items(const ItemTable *items) {
     FILE *file = fopen("items.txt", "w");
     if (file == NULL) {
         printf("Error opening file!\n");
         return;
     }
-    for (int i = 0; i < count; i++) {
-        fprintf(file, "%d,%s,%s,%d,%s,%s,%ld\n", items[i].id, items[i].name, items[i].brand, items[i].price, items[i].purchase_link, items[i].category, items[i].timestamp);
+    for (int i = 0; i < items->count; i++) {
+        const ItemText *text = &items->text[i];
+        fprintf(file, "%d,%s,%s,%d,%s,%s,%ld\n", items->id[i], text->name, text->brand, items->price[i], text->purchase_link, text->category, items->timestamp[i]);
     }
     fclose(file);
 }
 
+/*
+Description: Compares an item in the table against a search key.
+Parameters:
+items - Pointer to the item table.
+pos - Position of the item in the table.
+type - Sort key (1: Name, 2: Date, 3: Price, 4: Category then price).
+text - Name to compare against (used by type 1).
+category - Category code to compare against (used by type 4).
+key - Date or price to compare against (used by types 2, 3 and 4).
+Returns: A negative number, zero or a positive number if the item sorts before, together with or after the key.
+*/
+int compareItemToKey(const ItemTable *items, int pos, int type, const char *text, int category, long long key) {
+    if (type == 1) {
+        return strcmp(items->text[pos].name, text);
+    } else if (type == 2) {
+        return (items->timestamp[pos] > key) - (items->timestamp[pos] < key);
+    } else if (type == 3) {
+        return (items->price[pos] > key) - (items->price[pos] < key);
+    }
+    if (items->category[pos] != category) {
+        return (items->category[pos] > category) - (items->category[pos] < category);
+    }
+    return (items->price[pos] > key) - (items->price[pos] < key);
+}
+
+/*
+Description: Binary searches a sorted index for the position of a key.
+Parameters:
+order - Array of item positions sorted by the given key.
+count - Number of entries in the index.
+items - Pointer to the item table the index refers to.
+type - Sort key the index is ordered by (see compareItemToKey).
+text - Name to search for.
+category - Category code to search for.
+key - Date or price to search for.
+upper - 0 to return the first entry not before the key, 1 to return the first entry after it.
+Returns: The position in the index.
+*/
+int searchIndex(const int order[], int count, const ItemTable *items, int type, const char *text, int category,
+                long long key, int upper) {
+    int low = 0, high = count;
+    while (low < high) {
+        int mid = (low + high) / 2;
+        int cmp = compareItemToKey(items, order[mid], type, text, category, key);
+        if (cmp < 0 || (upper && cmp == 0)) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+/*
+Description: Inserts an item into a single sorted index, keeping it in order.
+Parameters:
+order - Array of item positions sorted by the given key.
+count - Number of entries currently in the index.
+items - Pointer to the item table the index refers to.
+item_pos - Position of the new item in the table.
+type - Sort key the index is ordered by (see compareItemToKey).
+Returns: None.
+*/
+void insertIntoIndex(int order[], int count, const ItemTable *items, int item_pos, int type) {
+    long long key = type == 2 ? (long long)items->timestamp[item_pos] : items->price[item_pos];
+    int pos = searchIndex(order, count, items, type, items->text[item_pos].name, items->category[item_pos], key, 1);
+    memmove(&order[pos + 1], &order[pos], (count - pos) * sizeof(int));
+    order[pos] = item_pos;
+}
+
+/*
+Description: Adds an item to all of the sorted indexes.
+Parameters:
+index - Pointer to the item index.
+items - Pointer to the item table the index refers to.
+item_pos - Position of the new item in the table.
+Returns: None.
+*/
+void addToItemIndex(ItemIndex *index, const ItemTable *items, int item_pos) {
+    insertIntoIndex(index->by_name, index->count, items, item_pos, 1);
+    insertIntoIndex(index->by_timestamp, index->count, items, item_pos, 2);
+    insertIntoIndex(index->by_price, index->count, items, item_pos, 3);
+    insertIntoIndex(index->by_category, index->count, items, item_pos, 4);
+    index->count++;
+}
+
+/*
+Description: Removes an item from a single sorted index and shifts down the positions after it.
+Parameters:
+order - Array of item positions sorted by some key.
+count - Number of entries currently in the index.
+item_pos - Position of the removed item in the table.
+Returns: None.
+*/
+void removeFromIndex(int order[], int count, int item_pos) {
+    int kept = 0;
+    for (int i = 0; i < count; i++) {
+        if (order[i] == item_pos) continue;
+        order[kept++] = order[i] > item_pos ? order[i] - 1 : order[i];
+    }
+}
+
+/*
+Description: Removes an item from all of the sorted indexes. Call this together with remove_item_at.
+Parameters:
+index - Pointer to the item index.
+item_pos - Position of the removed item in the table.
+Returns: None.
+*/
+void removeFromItemIndex(ItemIndex *index, int item_pos) {
+    removeFromIndex(index->by_name, index->count, item_pos);
+    removeFromIndex(index->by_timestamp, index->count, item_pos);
+    removeFromIndex(index->by_price, index->count, item_pos);
+    removeFromIndex(index->by_category, index->count, item_pos);
+    index->count--;
+}
+
+/*
+Description: Builds the sorted indexes for name, date, price and category over a list of items.
+Parameters:
+index - Pointer to the item index to fill in.
+items - Pointer to the item table.
+Returns: None.
+*/
+void buildItemIndex(ItemIndex *index, const ItemTable *items) {
+    index->count = 0;
+    for (int i = 0; i < items->count; i++) {
+        addToItemIndex(index, items, i);
+    }
+}
+
+/*
+Description: Finds the items matching a category, price range and earliest date using the sorted indexes.
+The date range and the category/price range are both located by binary search and only the smaller
+of the two is scanned, so the cost is O(log n) plus the size of that range rather than of the result.
+Parameters:
+index - Pointer to the item index.
+items - Pointer to the item table the index refers to.
+category - Category to match, or an empty string for any category.
+min_price - Lowest price to include, or INT_MIN for no minimum.
+max_price - Highest price to include, or INT_MAX for no maximum.
+since - Earliest timestamp to include.
+results - Array to store the positions of the matching items.
+Returns: The number of matching items.
+*/
+int queryItems(const ItemIndex *index, const ItemTable *items, const char *category,
+               int min_price, int max_price, time_t since, int results[]) {
+    int code = strlen(category) > 0 ? get_category_code(category) : -1;
+    const int *order = index->by_timestamp;
+    int start = searchIndex(order, index->count, items, 2, "", code, (long long)since, 0);
+    int end = index->count;
+    int found = 0;
+
+    if (strlen(category) > 0 && code < 0) return 0;
+    if (code >= 0 || min_price > INT_MIN || max_price < INT_MAX) {
+        const int *range_order = code >= 0 ? index->by_category : index->by_price;
+        int type = code >= 0 ? 4 : 3;
+        int range_start = searchIndex(range_order, index->count, items, type, "", code, min_price, 0);
+        int range_end = searchIndex(range_order, index->count, items, type, "", code, max_price, 1);
+        if (range_end - range_start < end - start) {
+            order = range_order;
+            start = range_start;
+            end = range_end;
+        }
+    }
+
+    for (int i = start; i < end; i++) {
+        int pos = order[i];
+        if (items->timestamp[pos] >= since && items->price[pos] >= min_price && items->price[pos] <= max_price &&
+            (code < 0 || items->category[pos] == code)) {
+            results[found++] = pos;
+        }
+    }
+    return found;
+}
+
 /*
 Description: Prompts the user to enter item details and saves the item.
-Parameters: None.
+Parameters:
+items - Pointer to the item table.
+index - Pointer to the sorted indexes over the items.
 Returns: None.
 */
-void addItem(){
+void addItem(ItemTable *items, ItemIndex *index){
 	Item item;
     char temp_price[MAX_LENGTH];
 
+    if (items->count >= MAX_ITEMS) {
+        printf("Item list is full!\n");
+        return;
+    }
+
     printf("Enter Item Name: ");
     fgets(item.name, MAX_LENGTH, stdin);
     item.name[strcspn(item.name, "\n")] = 0;
@@ -159,20 +438,26 @@ void addItem(){
 
     item.timestamp = time(NULL);
     item.id = generate_random_id();
+    item.budget_month = 0;
 
     save_item_to_file(&item);
+    append_item(items, &item);
+    addToItemIndex(index, items, items->count - 1);
     printf("Item added successfully! ID: %d\n", item.id);
 }
 
 /*
-Description: Displays the list of items and allows the user to remove one.
-Parameters: None.
+Description: Displays the list of items and allows the user to remove one. If the item is assigned to a
+budget, it is taken out of that budget and its price is added back to the remaining amount.
+Parameters:
+items - Pointer to the item table.
+index - Pointer to the sorted indexes over the items.
+budgets - Array of budget structures.
+budget_count - Number of budgets.
 Returns: None.
 */
-void removeItem(){
-    Item items[MAX_ITEMS];
-    int count;
-    load_items(items, &count);
+void removeItem(ItemTable *items, ItemIndex *index, Budget *budgets, int budget_count){
+    int count = items->count;
     
     if (count == 0) {
         printf("No items to remove.\n");
@@ -181,7 +466,7 @@ void removeItem(){
     
     printf("Items to remove:\n");
     for (int i = count - 1; i >= 0; i--) {
-        printf("[%d] %s (%s, %s) - %d\n    %s\n", count - i, items[i].name, items[i].brand, items[i].category, items[i].price, items[i].purchase_link);
+        printf("[%d] %s (%s, %s) - %d\n    %s\n", count - i, items->text[i].name, items->text[i].brand, items->text[i].category, items->price[i], items->text[i].purchase_link);
     }
     printf("[x] Back\n\n");
     
@@ -197,11 +482,21 @@ void removeItem(){
     }
     
     selection = count - selection;
-    for (int i = selection; i < count - 1; i++) {
-        items[i] = items[i + 1];
+    for (int b = 0; b < budget_count; b++) {
+        if (budgets[b].month != items->budget_month[selection]) continue;
+        for (int j = 0; j < budgets[b].item_count; j++) {
+            if (atoi(budgets[b].item_ids[j]) == items->id[selection]) {
+                memmove(budgets[b].item_ids[j], budgets[b].item_ids[j + 1], (budgets[b].item_count - j - 1) * sizeof(budgets[b].item_ids[0]));
+                budgets[b].item_count--;
+                budgets[b].remaining += items->price[selection];
+                break;
+            }
+        }
     }
-    count--;
-    save_items(items, count);
+
+    remove_item_at(items, selection);
+    removeFromItemIndex(index, selection);
+    save_items(items);
     printf("Item removed successfully!\n");
 }
 
@@ -210,11 +505,10 @@ Description: Allows the user to set a monthly budget and assign items to it.
 Parameters:
 budgets - Array of budget structures.
 budget_count - Pointer to the number of budgets.
-items - Array of items.
-item_count - Number of items.
+items - Pointer to the item table.
 Returns: None.
 */
-void setBudget(Budget *budgets, int *budget_count, Item *items, int item_count) {
+void setBudget(Budget *budgets, int *budget_count, ItemTable *items) {
     if (*budget_count >= MAX_BUDGETS) {
         printf("Budget list is full!\n");
         return;
@@ -244,12 +538,15 @@ void setBudget(Budget *budgets, int *budget_count, Item *items, int item_count)
 
     printf("\nUnbudgeted Items:\n");
     int available_items[MAX_ITEMS], available_count = 0;
-    for (int i = 0; i < item_count; i++) {
-        if (items[i].budget_month == 0) {
-            printf("[%d] %s (%s, %s) - %.2f\n", available_count + 1, items[i].name, items[i].brand, items[i].category, items[i].price / 100.0);
+    for (int i = 0; i < items->count; i++) {
+        if (items->budget_month[i] == 0) {
             available_items[available_count++] = i;
         }
     }
+    for (int i = 0; i < available_count; i++) {
+        const ItemText *text = &items->text[available_items[i]];
+        printf("[%d] %s (%s, %s) - %.2f\n", i + 1, text->name, text->brand, text->category, items->price[available_items[i]] / 100.0);
+    }
 
     while (available_count > 0) {
         int choice;
@@ -262,11 +559,11 @@ void setBudget(Budget *budgets, int *budget_count, Item *items, int item_count)
         if (choice > 0 && choice <= available_count) {
             int itemIndex = available_items[choice - 1];
 
-            if (newBudget.remaining >= items[itemIndex].price) {
-                strcpy(newBudget.item_ids[newBudget.item_count], items[itemIndex].id);
+            if (newBudget.remaining >= items->price[itemIndex]) {
+                sprintf(newBudget.item_ids[newBudget.item_count], "%d", items->id[itemIndex]);
                 newBudget.item_count++;
-                newBudget.remaining -= items[itemIndex].price;
-                items[itemIndex].budget_month = month;
+                newBudget.remaining -= items->price[itemIndex];
+                items->budget_month[itemIndex] = month;
                 printf("Item added to budget!\n");
             } else {
                 printf("Not enough budget for this item.\n");
@@ -286,11 +583,10 @@ Description: Displays details of the budget for a specific month.
 Parameters:
 budgets - Array of budget structures.
 budget_count - Number of budgets.
-items - Array of items.
-item_count - Number of items.
+items - Pointer to the item table.
 Returns: None.
 */
-void viewBudget(Budget *budgets, int budget_count, Item *items, int item_count) {
+void viewBudget(Budget *budgets, int budget_count, ItemTable *items) {
     if (budget_count == 0) {
         printf("No budgets set yet.\n");
         return;
@@ -311,9 +607,10 @@ void viewBudget(Budget *budgets, int budget_count, Item *items, int item_count)
             printf("Items in Budget:\n");
 
             for (int j = 0; j < budgets[i].item_count; j++) {
-                for (int k = 0; k < item_count; k++) {
-                    if (strcmp(budgets[i].item_ids[j], items[k].id) == 0) {
-                        printf("- %s (%s, %s) - %.2f\n", items[k].name, items[k].brand, items[k].category, items[k].price / 100.0);
+                int id = atoi(budgets[i].item_ids[j]);
+                for (int k = 0; k < items->count; k++) {
+                    if (items->id[k] == id) {
+                        printf("- %s (%s, %s) - %.2f\n", items->text[k].name, items->text[k].brand, items->text[k].category, items->price[k] / 100.0);
                         break;
                     }
                 }
@@ -332,11 +629,10 @@ Description: Allows the user to remove a budget and unassign its items.
 Parameters:
 budgets - Array of budget structures.
 budget_count - Pointer to the number of budgets.
-items - Array of items.
-item_count - Number of items.
+items - Pointer to the item table.
 Returns: None.
 */
-void removeBudget(Budget *budgets, int *budget_count, Item *items, int item_count) {
+void removeBudget(Budget *budgets, int *budget_count, ItemTable *items) {
     if (*budget_count == 0) {
         printf("No budgets to remove.\n");
         return;
@@ -362,9 +658,9 @@ void removeBudget(Budget *budgets, int *budget_count, Item *items, int item_coun
         }
         (*budget_count)--;
 
-        for (int i = 0; i < item_count; i++) {
-            if (items[i].budget_month == month) {
-                items[i].budget_month = 0;
+        for (int i = 0; i < items->count; i++) {
+            if (items->budget_month[i] == month) {
+                items->budget_month[i] = 0;
             }
         }
 
@@ -374,21 +670,241 @@ void removeBudget(Budget *budgets, int *budget_count, Item *items, int item_coun
     }
 }
 
+/*
+Description: Evaluates a single what-if scenario against a copy of the budgets and item assignments.
+Each scenario starts from the stored budget state (the money already committed and the items listed in
+each budget), so a scenario with no changes reproduces the current plan. Only the mutable parts of the
+state are copied, so the real budgets and items are never changed.
+Parameters:
+scenario - Pointer to the scenario to apply.
+budgets - Array of budget structures.
+budget_count - Number of budgets.
+items - Pointer to the item table.
+result - Pointer to the result structure to fill in.
+Returns: None.
+*/
+void simulateScenario(const Scenario *scenario, const Budget *budgets, int budget_count,
+                      const ItemTable *items, ScenarioResult *result) {
+    int budget_of[MAX_ITEMS];
+    int shift_code = strlen(scenario->shift_category) > 0 ? get_category_code(scenario->shift_category) : -1;
+    int target = -1;
+
+    for (int b = 0; b < budget_count; b++) {
+        long long scaled = (long long)budgets[b].budget * scenario->budget_percent / 100;
+        long long remaining = scaled - (budgets[b].budget - budgets[b].remaining);
+        result->remaining[b] = remaining > INT_MAX ? INT_MAX : (remaining < INT_MIN ? INT_MIN : (int)remaining);
+        result->dropped[b] = 0;
+        if (budgets[b].month == scenario->shift_month) {
+            target = b;
+        }
+    }
+    result->unbudgeted = 0;
+
+    for (int i = 0; i < items->count; i++) {
+        budget_of[i] = -1;
+    }
+    for (int b = 0; b < budget_count; b++) {
+        for (int j = 0; j < budgets[b].item_count; j++) {
+            int id = atoi(budgets[b].item_ids[j]);
+            for (int i = 0; i < items->count; i++) {
+                if (items->id[i] == id) {
+                    budget_of[i] = b;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (shift_code >= 0) {
+        for (int i = 0; i < items->count; i++) {
+            if (items->category[i] != shift_code || budget_of[i] == target) continue;
+            if (budget_of[i] >= 0) {
+                result->remaining[budget_of[i]] += items->price[i];
+            }
+            budget_of[i] = target;
+            if (target >= 0) {
+                result->remaining[target] -= items->price[i];
+            }
+        }
+    }
+
+    for (int i = items->count - 1; i >= 0; i--) {
+        int b = budget_of[i];
+        if (b >= 0 && result->remaining[b] < 0) {
+            result->remaining[b] += items->price[i];
+            result->dropped[b]++;
+            budget_of[i] = -1;
+        }
+    }
+
+    for (int i = 0; i < items->count; i++) {
+        if (budget_of[i] < 0) {
+            result->unbudgeted++;
+        }
+    }
+}
+
+/*
+Description: Prompts the user for a set of what-if scenarios, evaluates each one and prints a comparison
+table of the remaining budget and items left unbudgeted per month.
+Parameters:
+budgets - Array of budget structures.
+budget_count - Number of budgets.
+items - Pointer to the item table.
+Returns: None.
+*/
+void simulateBudgets(Budget *budgets, int budget_count, ItemTable *items) {
+    if (budget_count == 0) {
+        printf("No budgets set yet.\n");
+        return;
+    }
+
+    Scenario scenarios[MAX_SCENARIOS + 1];
+    ScenarioResult results[MAX_SCENARIOS + 1];
+    int scenario_count;
+
+    printf("Enter number of scenarios (1-%d): ", MAX_SCENARIOS);
+    scanf("%d", &scenario_count);
+    getchar();
+    if (scenario_count < 1 || scenario_count > MAX_SCENARIOS) {
+        printf("Invalid number of scenarios!\n");
+        return;
+    }
+
+    strcpy(scenarios[0].name, "Current plan");
+    scenarios[0].budget_percent = 100;
+    scenarios[0].shift_category[0] = 0;
+    scenarios[0].shift_month = 0;
+
+    for (int i = 1; i <= scenario_count; i++) {
+        Scenario *scenario = &scenarios[i];
+
+        printf("\nScenario %d name: ", i);
+        fgets(scenario->name, MAX_LENGTH, stdin);
+        scenario->name[strcspn(scenario->name, "\n")] = 0;
+
+        printf("Budget change in percent (0-%d, 100 = unchanged, 90 = cut by 10%%): ", MAX_BUDGET_PERCENT);
+        scanf("%d", &scenario->budget_percent);
+        getchar();
+        if (scenario->budget_percent < 0 || scenario->budget_percent > MAX_BUDGET_PERCENT) {
+            printf("Invalid percentage, using 100.\n");
+            scenario->budget_percent = 100;
+        }
+
+        printf("Category to move (leave empty for none): ");
+        fgets(scenario->shift_category, MAX_LENGTH, stdin);
+        scenario->shift_category[strcspn(scenario->shift_category, "\n")] = 0;
+        scenario->shift_month = 0;
+        if (strlen(scenario->shift_category) > 0) {
+            if (!is_valid_category(scenario->shift_category)) {
+                printf("Invalid category, no items will be moved.\n");
+                scenario->shift_category[0] = 0;
+            } else {
+                printf("Move to month (1-12): ");
+                scanf("%d", &scenario->shift_month);
+                getchar();
+                if (scenario->shift_month < 1 || scenario->shift_month > 12) {
+                    printf("Invalid month, no items will be moved.\n");
+                    scenario->shift_category[0] = 0;
+                    scenario->shift_month = 0;
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i <= scenario_count; i++) {
+        simulateScenario(&scenarios[i], budgets, budget_count, items, &results[i]);
+    }
+
+    printf("\nScenario comparison (remaining budget, items left unbudgeted in brackets):\n");
+    printf("%-20s", "Scenario");
+    for (int b = 0; b < budget_count; b++) {
+        printf("%16s", (char *[]){"January", "February", "March", "April", "May", "June",
+                                  "July", "August", "September", "October", "November", "December"}[budgets[b].month - 1]);
+    }
+    printf("%12s\n", "Unbudgeted");
+
+    for (int i = 0; i <= scenario_count; i++) {
+        printf("%-20.20s", scenarios[i].name);
+        for (int b = 0; b < budget_count; b++) {
+            char cell[32];
+            sprintf(cell, "%d (%d)", results[i].remaining[b], results[i].dropped[b]);
+            printf("%16s", cell);
+        }
+        printf("%12d\n", results[i].unbudgeted);
+    }
+}
+
+/*
+Description: Prompts the user for a category, price range and age and displays the matching items.
+Parameters:
+index - Pointer to the item index.
+items - Pointer to the item table.
+Returns: None.
+*/
+void filterItems(const ItemIndex *index, ItemTable *items) {
+    char category[MAX_LENGTH];
+    char temp_price[MAX_LENGTH];
+    int min_price = INT_MIN, max_price = INT_MAX, days;
+    time_t since = 0;
+    int results[MAX_ITEMS];
+
+    printf("Enter Category (leave empty for any): ");
+    fgets(category, MAX_LENGTH, stdin);
+    category[strcspn(category, "\n")] = 0;
+    if (strlen(category) > 0 && !is_valid_category(category)) {
+        printf("Invalid category!\n");
+        return;
+    }
+
+    printf("Enter Minimum Price (leave empty for none): ");
+    fgets(temp_price, MAX_LENGTH, stdin);
+    if (temp_price[0] != '\n') {
+        min_price = (int)(atof(temp_price) * 100);
+    }
+
+    printf("Enter Maximum Price (leave empty for none): ");
+    fgets(temp_price, MAX_LENGTH, stdin);
+    if (temp_price[0] != '\n') {
+        max_price = (int)(atof(temp_price) * 100);
+    }
+
+    printf("Only items added in the last how many days (0 for all): ");
+    scanf("%d", &days);
+    getchar();
+    if (days > 0) {
+        since = time(NULL) - (time_t)days * 24 * 60 * 60;
+    }
+
+    int found = queryItems(index, items, category, min_price, max_price, since, results);
+
+    printf("\nMatching items:\n");
+    for (int i = 0; i < found; i++) {
+        const ItemText *text = &items->text[results[i]];
+        printf("%s (%s, %s) - %.2f\n  %s\n",
+               text->name, text->brand, text->category, items->price[results[i]] / 100.0, text->purchase_link);
+    }
+    if (found == 0) {
+        printf("No items match the filter.\n");
+    }
+}
+
 /*
 Description: Displays a summary menu to show items and budget details.
 Parameters:
-items - Array of items.
-item_count - Number of items.
+items - Pointer to the item table.
+index - Pointer to the sorted indexes over the items.
 budgets - Array of budgets.
 budget_count - Number of budgets.
 Returns: None.
 */
-void summarize(Item items[], int item_count, Budget budgets[], int budget_count) {
+void summarize(ItemTable *items, const ItemIndex *index, Budget budgets[], int budget_count) {
     char choice;
     do {
         printf("\nSummarize\n");
         printf("[1] Items added\n");
         printf("[2] Budget summary\n");
+        printf("[3] Filter items\n");
         printf("[x] Back\n");
         printf("Enter choice: ");
         scanf(" %c", &choice);
@@ -396,10 +912,13 @@ void summarize(Item items[], int item_count, Budget budgets[], int budget_count)
 
         switch (choice) {
             case '1':
-                summarizeItems(items, item_count);
+                summarizeItems(items, index);
                 break;
             case '2':
-                summarizeBudget(budgets, budget_count, items, item_count);
+                summarizeBudget(budgets, budget_count, items);
+                break;
+            case '3':
+                filterItems(index, items);
                 break;
             case 'x':
                 return;
@@ -412,27 +931,26 @@ void summarize(Item items[], int item_count, Budget budgets[], int budget_count)
 /*
 Description: Displays the list of added items with sorting options.
 Parameters:
-items - Array of items.
-item_count - Number of items.
+items - Pointer to the item table.
+index - Pointer to the sorted indexes over the items.
 Returns: None.
 */
-void summarizeItems(Item items[], int item_count) {
+void summarizeItems(ItemTable *items, const ItemIndex *index) {
     char choice;
-    int sortType = 1;
+    const int *order = index->by_name;
     int ascending = 1;
 
     do {
-        sortItems(items, item_count, sortType, ascending);
-
         printf("\nItems added:\n");
-        for (int i = 0; i < item_count; i++) {
+        for (int n = 0; n < index->count; n++) {
+            int i = order[ascending == 1 ? n : index->count - 1 - n];
             printf("%s (%s, %s) - %.2f\n  %s\n",
-                   items[i].name, items[i].brand, items[i].category,
-                   items[i].price / 100.0, items[i].purchase_link);
-            if (items[i].budget_month != 0) {
+                   items->text[i].name, items->text[i].brand, items->text[i].category,
+                   items->price[i] / 100.0, items->text[i].purchase_link);
+            if (items->budget_month[i] != 0) {
                 printf("  To be purchased on: %s\n", 
                        (char *[]){"January", "February", "March", "April", "May", "June",
-                                  "July", "August", "September", "October", "November", "December"}[items[i].budget_month - 1]);
+                                  "July", "August", "September", "October", "November", "December"}[items->budget_month[i] - 1]);
             } else {
                 printf("  Not yet budgeted\n");
             }
@@ -444,68 +962,28 @@ void summarizeItems(Item items[], int item_count) {
         getchar();
 
         if (choice == 'q') {
-            sortType = 2;
+            order = index->by_timestamp;
             ascending *= -1;
         } else if (choice == 'w') {
-            sortType = 3;
+            order = index->by_price;
             ascending *= -1;
         } else if (choice == 'e') {
-            sortType = 1;
+            order = index->by_name;
             ascending *= -1;
         }
 
     } while (choice != 'x');
 }
 
-/*
-Description: Sorts the list of items based on name, date, or price.
-Parameters:
-items - Array of items.
-count - Number of items.
-type - Sorting type (1: Name, 2: Date, 3: Price).
-ascending - Sorting order (1: Ascending, -1: Descending).
-Returns: None.
-*/
-void sortItems(Item items[], int count, int type, int ascending) {
-    for (int i = 0; i < count - 1; i++) {
-        for (int j = i + 1; j < count; j++) {
-            int swap = 0;
-            if (type == 1) { // Sort by name
-                if ((ascending == 1 && strcmp(items[i].name, items[j].name) > 0) ||
-                    (ascending == -1 && strcmp(items[i].name, items[j].name) < 0)) {
-                    swap = 1;
-                }
-            } else if (type == 2) { // Sort by date
-                if ((ascending == 1 && items[i].timestamp > items[j].timestamp) ||
-                    (ascending == -1 && items[i].timestamp < items[j].timestamp)) {
-                    swap = 1;
-                }
-            } else if (type == 3) { // Sort by price
-                if ((ascending == 1 && items[i].price > items[j].price) ||
-                    (ascending == -1 && items[i].price < items[j].price)) {
-                    swap = 1;
-                }
-            }
-
-            if (swap) {
-                Item temp = items[i];
-                items[i] = items[j];
-                items[j] = temp;
-            }
-        }
-    }
-}
-
 /*
 Description: Displays a summary of the total budget, remaining budget, and number of items per month.
 Parameters:
 budgets - Array of budgets.
 budget_count - Number of budgets.
-items - Array of items.
-item_count - Number of items.
+items - Pointer to the item table.
 Returns: None.
 */
-void summarizeBudget(Budget budgets[], int budget_count, Item items[], int item_count) {
+void summarizeBudget(Budget budgets[], int budget_count, ItemTable *items) {
     char choice;
     do {
         printf("\nBudget Summary:\n");
@@ -523,7 +1001,7 @@ void summarizeBudget(Budget budgets[], int budget_count, Item items[], int item_
         getchar();
 
         if (choice == 'v') {
-            viewBudgetDetails(budgets, budget_count, items, item_count);
+            viewBudgetDetails(budgets, budget_count, items);
         }
     } while (choice != 'x');
 }
@@ -533,11 +1011,10 @@ Description: Displays detailed budget information for a selected month.
 Parameters:
 budgets - Array of budgets.
 budget_count - Number of budgets.
-items - Array of items.
-item_count - Number of items.
+items - Pointer to the item table.
 Returns: None.
 */
-void viewBudgetDetails(Budget budgets[], int budget_count, Item items[], int item_count) {
+void viewBudgetDetails(Budget budgets[], int budget_count, ItemTable *items) {
     int month;
     printf("Enter month to view details (1-12): ");
     scanf("%d", &month);
@@ -552,10 +1029,11 @@ void viewBudgetDetails(Budget budgets[], int budget_count, Item items[], int ite
             printf("Items in Budget:\n");
 
             for (int j = 0; j < budgets[i].item_count; j++) {
-                for (int k = 0; k < item_count; k++) {
-                    if (budgets[i].item_ids[j] == items[k].id) {
+                int id = atoi(budgets[i].item_ids[j]);
+                for (int k = 0; k < items->count; k++) {
+                    if (items->id[k] == id) {
                         printf("- %s (%s, %s) - %.2f\n", 
-                               items[k].name, items[k].brand, items[k].category, items[k].price / 100.0);
+                               items->text[k].name, items->text[k].brand, items->text[k].category, items->price[k] / 100.0);
                         break;
                     }
                 }
@@ -581,10 +1059,14 @@ void displayMenu1() {
 
 /*
 Description: Handles the add/remove item menu loop.
-Parameters: None.
+Parameters:
+items - Pointer to the item table.
+index - Pointer to the sorted indexes over the items.
+budgets - Array of budgets.
+budget_count - Number of budgets.
 Returns: None.
 */
-void addItemMenu() {
+void addItemMenu(ItemTable *items, ItemIndex *index, Budget budgets[], int budget_count) {
     char choice;
     do {
         displayMenu1();
@@ -594,10 +1076,10 @@ void addItemMenu() {
 
         switch (choice) {
             case '1':
-                addItem();
+                addItem(items, index);
                 break;
             case '2':
-                removeItem();
+                removeItem(items, index, budgets, budget_count);
                 break;
             case 'x':
                 return;
@@ -617,19 +1099,19 @@ void displayMenu2() {
     printf("[1] Set budget\n");
     printf("[2] View budget\n");
     printf("[3] Remove month from budget\n");
+    printf("[4] Simulate what-if scenarios\n");
     printf("[x] Back\n");
 }
 
 /*
-Description: Handles budget-related operations, including setting, viewing, and removing budgets.
+Description: Handles budget-related operations, including setting, viewing, removing and simulating budgets.
 Parameters:
 budgets - Array of budgets.
 budget_count - Pointer to the number of budgets.
-items - Array of items.
-item_count - Number of items.
+items - Pointer to the item table.
 Returns: None.
 */
-void budgetItems(Budget budgets[], int *budget_count, Item items[], int item_count) {
+void budgetItems(Budget budgets[], int *budget_count, ItemTable *items) {
     char choice;
     do {
         displayMenu2();
@@ -639,13 +1121,16 @@ void budgetItems(Budget budgets[], int *budget_count, Item items[], int item_cou
 
         switch (choice) {
             case '1':
-                setBudget(budgets, budget_count, items, item_count);
+                setBudget(budgets, budget_count, items);
                 break;
             case '2':
-                viewBudget(budgets, *budget_count, items, item_count);
+                viewBudget(budgets, *budget_count, items);
                 break;
             case '3':
-                removeBudget(budgets, budget_count, items, item_count);
+                removeBudget(budgets, budget_count, items);
+                break;
+            case '4':
+                simulateBudgets(budgets, *budget_count, items);
                 break;
             case 'x':
                 return;
@@ -672,11 +1157,13 @@ int main() {
 	srand(time(NULL));
     Budget budgets[MAX_ITEMS];
     int budget_count = 0;
-    Item items[MAX_ITEMS];
-    int item_count = 0;
+    ItemTable items;
+    ItemIndex index;
     char choice;
     
     printf("Welcome to Lilipat!\n");
+    load_items(&items);
+    buildItemIndex(&index, &items);
     
     do {
         displayMenu();
@@ -686,13 +1173,13 @@ int main() {
         
         switch (choice) {
             case '1':
-                addItemMenu();
+                addItemMenu(&items, &index, budgets, budget_count);
                 break;
             case '2':
-                budgetItems(budgets, &budget_count, items, item_count);
+                budgetItems(budgets, &budget_count, &items);
                 break;
             case '3':
-                summarize(items, item_count, budgets, budget_count);
+                summarize(&items, &index, budgets, budget_count);
                 break;
             case 'x':
             case 'X':